@@ -111,6 +111,13 @@ enum class Resolutions
     Double                                                                      ///< Double resolution
 };
 
+enum class VTKFormats                                                           ///< Available VTK output formats
+{
+    ASCII,                                                                      ///< XML StructuredGrid with ASCII point data
+    Binary,                                                                     ///< XML ImageData with raw appended binary point data
+    Compressed                                                                  ///< XML ImageData with zlib compressed appended point data
+};
+
 enum class AdvectionSchemes                                                     ///< Available advection schemes
 {
     Upwind,
@@ -30,6 +30,7 @@
 
 #include "Base/Includes.h"
 #include "Base/NodeV3.h"
+#include "Base/SmallVector.h"
 
 namespace openphase
 {
@@ -68,15 +69,13 @@ struct PhaseFieldEntry
 class NodePF                                                                     ///< Stores the phase-fields and their derivatives at a grid point. Provides access and manipulation methods for the phase-field entries.
 {
  public:
-    NodePF()                                                                     ///< Constructor used to allocate space for at least 3 fields
+    NodePF()                                                                     ///< Constructor, space for 3 fields is allocated inline
     {
-        Fields.reserve(3);
         flag = 0;
     }
 
-    NodePF(const NodePF& n)                                                       ///< Constructor used to allocate space for at least 3 fields
+    NodePF(const NodePF& n)                                                       ///< Copy constructor
     {
-        Fields.reserve(3);
         Fields = n.Fields;
         flag   = n.flag;
     }
@@ -129,8 +128,8 @@ class NodePF
 
     PhaseFieldEntry get_max(void) const;                                        ///< Returns FieldEntry with max value
 
-    typedef std::vector<PhaseFieldEntry>::iterator iterator;                    ///< Iterator over storage vector.
-    typedef std::vector<PhaseFieldEntry>::const_iterator citerator;             ///< Constant iterator over storage vector.
+    typedef SmallVector<PhaseFieldEntry,3>::iterator iterator;                  ///< Iterator over storage vector.
+    typedef SmallVector<PhaseFieldEntry,3>::const_iterator citerator;           ///< Constant iterator over storage vector.
     iterator  begin() {return Fields.begin();};                                 ///< Iterator to the begin of storage vector.
     iterator  end()   {return Fields.end();};                                   ///< Iterator to the end of storage vector.
     citerator cbegin() const {return Fields.cbegin();};                         ///< Constant iterator to the begin of storage vector.
@@ -148,7 +147,7 @@ class NodePF
     int flag;                                                                   ///< Interface flag: 1 if node is near the interface, 2 if it is in the interface and 0 if it is in the bulk.
  protected:
  private:
-    std::vector<PhaseFieldEntry> Fields;                                        ///< Storage vector.
+    SmallVector<PhaseFieldEntry,3> Fields;                                      ///< Storage vector. Up to 3 fields are stored inline without heap allocations.
 };
 
 /******************************* Implementation ******************************/
@@ -0,0 +1,178 @@
+/*
+ *   This file is part of the OpenPhase (R) software library.
+ *
+ *   Copyright (c) 2009-2022 Ruhr-Universitaet Bochum,
+ *                 Universitaetsstrasse 150, D-44801 Bochum, Germany
+ *             AND 2018-2022 OpenPhase Solutions GmbH,
+ *                 Universitaetsstrasse 136, D-44799 Bochum, Germany.
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   File created :   2022
+ *   Main contributors :   Oleg Shchyglo
+ *
+ */
+
+#ifndef SMALLVECTOR_H
+#define SMALLVECTOR_H
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace openphase
+{
+
+template <class T, size_t N>
+class SmallVector  /// Vector-like storage with N elements kept inline. Heap memory is only used if more than N elements are stored
+{
+ public:
+    typedef T* iterator;                                                        ///< Iterator over the stored elements
+    typedef const T* const_iterator;                                            ///< Constant iterator over the stored elements
+
+    SmallVector()
+    {
+        Heap = nullptr;
+        Size = 0;
+        Capacity = N;
+    }
+    SmallVector(const SmallVector<T,N>& rhs)
+    {
+        Heap = nullptr;
+        Size = 0;
+        Capacity = N;
+        *this = rhs;
+    }
+    SmallVector<T,N>& operator=(const SmallVector<T,N>& rhs)
+    {
+        if(this != &rhs)
+        {
+            Size = 0;
+            reserve(rhs.Size);
+            const T* src = rhs.data();
+            T* dst = data();
+            for(size_t n = 0; n != rhs.Size; n++)
+            {
+                dst[n] = src[n];
+            }
+            Size = rhs.Size;
+        }
+        return *this;
+    }
+    ~SmallVector()
+    {
+        delete[] Heap;
+    }
+
+    T* data()
+    {
+        return (Heap) ? Heap : Local;
+    }
+    const T* data() const
+    {
+        return (Heap) ? Heap : Local;
+    }
+    T& operator[](const size_t n)
+    {
+        assert(n < Size && "Access beyond storage range");
+        return data()[n];
+    }
+    T const& operator[](const size_t n) const
+    {
+        assert(n < Size && "Access beyond storage range");
+        return data()[n];
+    }
+
+    iterator begin() {return data();};
+    iterator end()   {return data() + Size;};
+    const_iterator begin() const {return data();};
+    const_iterator end()   const {return data() + Size;};
+    const_iterator cbegin() const {return data();};
+    const_iterator cend()   const {return data() + Size;};
+
+    T& front() {return data()[0];};
+    const T& front() const {return data()[0];};
+
+    size_t size() const {return Size;};
+    size_t capacity() const {return Capacity;};
+    bool empty() const {return Size == 0;};
+
+    void clear()
+    {
+        /// Keeps the overflow memory (if any) to avoid repeated reallocations
+        Size = 0;
+    }
+    void reserve(const size_t n)
+    {
+        if(n > Capacity)
+        {
+            size_t newCapacity = 2*Capacity;
+            while(newCapacity < n) newCapacity *= 2;
+
+            T* newHeap = new T[newCapacity];
+            T* old = data();
+            for(size_t i = 0; i != Size; i++)
+            {
+                newHeap[i] = std::move(old[i]);
+            }
+            delete[] Heap;
+            Heap = newHeap;
+            Capacity = newCapacity;
+        }
+    }
+    void resize(const size_t n)
+    {
+        reserve(n);
+        T* ptr = data();
+        for(size_t i = Size; i < n; i++)
+        {
+            ptr[i] = T();
+        }
+        Size = n;
+    }
+    void push_back(const T& value)
+    {
+        if(Size == Capacity)
+        {
+            T tmp = value;                                                      // value may refer to an element of this storage
+            reserve(Size + 1);
+            data()[Size] = std::move(tmp);
+        }
+        else
+        {
+            data()[Size] = value;
+        }
+        Size++;
+    }
+    iterator erase(iterator it)
+    {
+        assert(it >= begin() && it < end() && "Erasing beyond storage range");
+        for(iterator next = it + 1; next != end(); ++next)
+        {
+            *(next - 1) = std::move(*next);
+        }
+        Size--;
+        return it;
+    }
+
+ protected:
+ private:
+    T  Local[N];                                                                ///< Inline storage for the first N elements
+    T* Heap;                                                                    ///< Overflow storage, nullptr if inline storage is used
+    size_t Size;                                                                ///< Number of stored elements
+    size_t Capacity;                                                            ///< Number of elements which can be stored without reallocation
+};
+
+}// namespace openphase
+#endif
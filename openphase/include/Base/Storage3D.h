@@ -111,20 +111,32 @@ public:
     };
 };
 
+template <class T, int Rank>
+class Storage3D;
+
+template <typename A>
+struct has_fixed_pack_size : std::false_type {};                                ///< True if packed size of a window only depends on the window size
+
+template <class T, int Rank>
+struct has_fixed_pack_size<Storage3D<T,Rank>> : std::integral_constant<bool, !std::is_class<T>::value && std::is_pod<T>::value> {};
+
 template <typename A, typename T>
 class PackCallerTensor<A, T, typename std::enable_if<!std::is_class<T>::value && std::is_pod<T>::value>::type>
 {
  public:
     static T pack(A& self, std::vector<double>& buffer, std::vector<long int> window)
     {
-        buffer.clear();
+        const size_t npoints = (window[1]-window[0])*(window[3]-window[2])*(window[5]-window[4]);
+        const size_t tsize = (npoints) ? self(window[0],window[2],window[4]).size() : 0;
+        buffer.resize(npoints*tsize);
+        size_t it = 0;
         for (long int i = window[0]; i < window[1]; ++i)
         for (long int j = window[2]; j < window[3]; ++j)
         for (long int k = window[4]; k < window[5]; ++k)
         {
-            for (size_t n = 0; n < self(i,j,k).size(); ++n)
+            for (size_t n = 0; n < tsize; ++n)
             {
-                buffer.push_back(self(i,j,k)[n]);
+                buffer[it] = self(i,j,k)[n]; ++it;
             }
         }
         return T();
@@ -200,23 +212,46 @@ class PackCaller<A, T, typename std::enable_if<!std::is_class<T>::value && std::
  public:
     static T pack(A& self, std::vector<double>& buffer, std::vector<long int> window)
     {
-        buffer.clear();
+        const size_t nz = window[5] - window[4];
+        buffer.resize((window[1]-window[0])*(window[3]-window[2])*nz);
+        size_t it = 0;
         for (long int i = window[0]; i < window[1]; ++i)
         for (long int j = window[2]; j < window[3]; ++j)
-        for (long int k = window[4]; k < window[5]; ++k)
         {
-            buffer.push_back(self(i,j,k));
+            if constexpr (std::is_same<T, double>::value)
+            {
+                memcpy(&buffer[it], &self(i,j,window[4]), nz*sizeof(double));   // Z-rows are contiguous in memory
+                it += nz;
+            }
+            else
+            {
+                for (long int k = window[4]; k < window[5]; ++k)
+                {
+                    buffer[it] = self(i,j,k); ++it;
+                }
+            }
         }
         return T();
     }
     static T unpack(A& self, std::vector<double>& buffer, std::vector<long int> window)
     {
+        const size_t nz = window[5] - window[4];
         size_t it = 0;
         for (long int i = window[0]; i < window[1]; ++i)
         for (long int j = window[2]; j < window[3]; ++j)
-        for (long int k = window[4]; k < window[5]; ++k)
         {
-            self(i,j,k) = buffer[it]; ++it;
+            if constexpr (std::is_same<T, double>::value)
+            {
+                memcpy(&self(i,j,window[4]), &buffer[it], nz*sizeof(double));   // Z-rows are contiguous in memory
+                it += nz;
+            }
+            else
+            {
+                for (long int k = window[4]; k < window[5]; ++k)
+                {
+                    self(i,j,k) = buffer[it]; ++it;
+                }
+            }
         }
         return T();
     }
@@ -674,6 +709,13 @@ class Storage3D
         return buffer;
     }
 
+    void pack(std::vector<double>& buffer, std::vector<long int> window)       ///< Packs window into an existing buffer, reusing its memory
+    {
+        buffer.clear();
+        PackCallerTensor< Storage3D<T,Rank>, T> K;
+        K.pack(*this, buffer, window);
+    }
+
     void unpack(std::vector<double>& buffer, std::vector<long int> window)
     {
         PackCallerTensor< Storage3D<T,Rank>, T> K;
@@ -1314,6 +1356,13 @@ class Storage3D<T,0>
         return buffer;
     }
 
+    void pack(std::vector<double>& buffer, std::vector<long int> window)       ///< Packs window into an existing buffer, reusing its memory
+    {
+        buffer.clear();
+        PackCaller< Storage3D<T,0>, T> K;
+        K.pack(*this, buffer, window);
+    }
+
     void unpack(std::vector<double>& buffer, std::vector<long int> window)
     {
         PackCaller< Storage3D<T,0>, T> K;
@@ -147,6 +147,13 @@ class OP_EXPORTS BoundaryConditions : public OPObject
     BoundaryConditionTypes TranslateBoundaryConditions(std::string Key);        ///< Translates input string into the valid boundary condition designation
  protected:
  private:
+#ifdef MPI_PARALLEL
+    template<typename A> void ExchangeHalos(A& storage, const int direction,
+                                            const int LeftProcess, const int RightProcess,
+                                            const bool left, const bool right) const;///< Exchanges boundary cells with the neighbour ranks along a given direction
+
+    mutable std::array<std::vector<double>, 4> HaloBuffers;                     ///< Persistent halo buffers: send left, send right, receive left, receive right
+#endif
 
 };
 
@@ -2347,103 +2354,105 @@ void BoundaryConditions::SetZVector(Storage3D<T, 3> &Field) const
 
 #ifdef MPI_PARALLEL
 template<typename A>
-inline void BoundaryConditions::Communicate([[maybe_unused]] A& storage) const
+inline void BoundaryConditions::ExchangeHalos(A& storage, const int direction,
+                                              const int LeftProcess, const int RightProcess,
+                                              const bool left, const bool right) const
 {
-    std::vector<double> sleft;
-    std::vector<double> rleft;
-    std::vector<double> sright;
-    std::vector<double> rright;
-    MPI_Request request_sleft;
-    MPI_Request request_sleft_size;
-    MPI_Request request_sright;
-    MPI_Request request_sright_size;
-    MPI_Request request_rleft;
-    MPI_Request request_rleft_size;
-    MPI_Request request_rright;
-    MPI_Request request_rright_size;
-
-    int sleft_size;
-    int sright_size;
-    const int RightProcess = (((MPI_RANK+1)%MPI_SIZE)+MPI_SIZE)%MPI_SIZE;
-    const int LeftProcess  = (((MPI_RANK-1)%MPI_SIZE)+MPI_SIZE)%MPI_SIZE;
+    /// Exchanges the boundary cells of the storage with the neighbour ranks
+    /// along the given direction (0 = X, 1 = Y, 2 = Z). Send and receive
+    /// buffers are kept between the calls, so no memory is allocated once
+    /// the largest storage has been communicated. Storages of POD values have
+    /// a known message size and receive directly into the preallocated
+    /// buffers; for other storages the size is obtained by probing.
 
-    const int LeftSizeTag  = 0; // used to identify data stream
     const int LeftDataTag  = 2; // used to identify data stream
-    const int RightSizeTag = 4; // used to identify data stream
     const int RightDataTag = 8; // used to identify data stream
 
-    if(MPI_RANK > 0 or MPIperiodicX)
-    {
-        std::vector<long int> window(6);
-        window[0] = 0;
-        window[1] = storage.BcellsX();
-        window[2] = -storage.BcellsY();
-        window[3] = storage.sizeY()+storage.BcellsY();
-        window[4] = -storage.BcellsZ();
-        window[5] = storage.sizeZ()+storage.BcellsZ();
-        sleft = storage.pack(window);
-        sleft_size = sleft.size();
-        MPI_Isend(&sleft_size  , 1          , MPI_INT    , LeftProcess , RightSizeTag , MPI_COMM_WORLD , &request_sleft_size);
-        MPI_Isend(sleft.data() , sleft_size , MPI_DOUBLE , LeftProcess , RightDataTag , MPI_COMM_WORLD , &request_sleft);
-    }
-    if(MPI_RANK < MPI_SIZE-1 or MPIperiodicX)
-    {
-        std::vector<long int> window(6);
-        window[0] = storage.sizeX()-storage.BcellsX();
-        window[1] = storage.sizeX();
-        window[2] = -storage.BcellsY();
-        window[3] = storage.sizeY()+storage.BcellsY();
-        window[4] = -storage.BcellsZ();
-        window[5] = storage.sizeZ()+storage.BcellsZ();
-        sright = storage.pack(window);
-        sright_size = sright.size();
-        MPI_Isend(&sright_size  , 1           , MPI_INT    , RightProcess , LeftSizeTag , MPI_COMM_WORLD , &request_sright_size);
-        MPI_Isend(sright.data() , sright_size , MPI_DOUBLE , RightProcess , LeftDataTag , MPI_COMM_WORLD , &request_sright);
-    }
-    if(MPI_RANK > 0 or MPIperiodicX)
+    const long int size   = (direction == 0) ? storage.sizeX()   : (direction == 1) ? storage.sizeY()   : storage.sizeZ();
+    const long int bcells = (direction == 0) ? storage.BcellsX() : (direction == 1) ? storage.BcellsY() : storage.BcellsZ();
+
+    auto Window = [&storage, direction](const long int begin, const long int end)
     {
-        long int size = 0;
-        MPI_Irecv(&size, 1, MPI_INT, LeftProcess, LeftSizeTag, MPI_COMM_WORLD, &request_rleft_size);
-        MPI_Wait(&request_rleft_size, MPI_STATUS_IGNORE);
-        rleft.resize(size);
-        MPI_Irecv(rleft.data(), size, MPI_DOUBLE, LeftProcess, LeftDataTag, MPI_COMM_WORLD, &request_rleft);
-        MPI_Wait(&request_rleft, MPI_STATUS_IGNORE);
         std::vector<long int> window(6);
         window[0] = -storage.BcellsX();
-        window[1] = 0;
+        window[1] = storage.sizeX()+storage.BcellsX();
         window[2] = -storage.BcellsY();
         window[3] = storage.sizeY()+storage.BcellsY();
         window[4] = -storage.BcellsZ();
         window[5] = storage.sizeZ()+storage.BcellsZ();
-        storage.unpack(rleft,window);
+        window[2*direction]   = begin;
+        window[2*direction+1] = end;
+        return window;
+    };
+
+    std::vector<double>& sleft  = HaloBuffers[0];
+    std::vector<double>& sright = HaloBuffers[1];
+    std::vector<double>& rleft  = HaloBuffers[2];
+    std::vector<double>& rright = HaloBuffers[3];
+
+    MPI_Request requests[4];
+    int nrequests = 0;
+
+    if(left)  storage.pack(sleft,  Window(0, bcells));
+    if(right) storage.pack(sright, Window(size - bcells, size));
+
+    if constexpr (has_fixed_pack_size<A>::value)
+    {
+        if(left)
+        {
+            rleft.resize(sleft.size());
+            MPI_Irecv(rleft.data(), rleft.size(), MPI_DOUBLE, LeftProcess, LeftDataTag, MPI_COMM_WORLD, &requests[nrequests++]);
+        }
+        if(right)
+        {
+            rright.resize(sright.size());
+            MPI_Irecv(rright.data(), rright.size(), MPI_DOUBLE, RightProcess, RightDataTag, MPI_COMM_WORLD, &requests[nrequests++]);
+        }
     }
-    if (MPI_RANK < MPI_SIZE-1 or MPIperiodicX)
+    if(left)
     {
-        long int size = 0;
-        MPI_Irecv(&size, 1, MPI_INT, RightProcess, RightSizeTag, MPI_COMM_WORLD, &request_rright_size);
-        MPI_Wait(&request_rright_size, MPI_STATUS_IGNORE);
-        rright.resize(size);
-        MPI_Irecv(rright.data(), size, MPI_DOUBLE, RightProcess, RightDataTag, MPI_COMM_WORLD, &request_rright);
-        MPI_Wait(&request_rright, MPI_STATUS_IGNORE);
-        std::vector<long int> window(6);
-        window[0] = storage.sizeX();
-        window[1] = storage.sizeX()+storage.BcellsX();
-        window[2] = -storage.BcellsY();
-        window[3] = storage.sizeY()+storage.BcellsY();
-        window[4] = -storage.BcellsZ();
-        window[5] = storage.sizeZ()+storage.BcellsZ();
-        storage.unpack(rright,window);
+        MPI_Isend(sleft.data(), sleft.size(), MPI_DOUBLE, LeftProcess, RightDataTag, MPI_COMM_WORLD, &requests[nrequests++]);
     }
-    if (MPI_RANK > 0 or MPIperiodicX)
+    if(right)
     {
-        MPI_Wait(&request_sleft, MPI_STATUS_IGNORE);
-        MPI_Wait(&request_sleft_size, MPI_STATUS_IGNORE);
+        MPI_Isend(sright.data(), sright.size(), MPI_DOUBLE, RightProcess, LeftDataTag, MPI_COMM_WORLD, &requests[nrequests++]);
     }
-    if (MPI_RANK < MPI_SIZE-1 or MPIperiodicX)
+    if constexpr (!has_fixed_pack_size<A>::value)
     {
-        MPI_Wait(&request_sright, MPI_STATUS_IGNORE);
-        MPI_Wait(&request_sright_size, MPI_STATUS_IGNORE);
+        if(left)
+        {
+            MPI_Status status;
+            int count = 0;
+            MPI_Probe(LeftProcess, LeftDataTag, MPI_COMM_WORLD, &status);
+            MPI_Get_count(&status, MPI_DOUBLE, &count);
+            rleft.resize(count);
+            MPI_Irecv(rleft.data(), count, MPI_DOUBLE, LeftProcess, LeftDataTag, MPI_COMM_WORLD, &requests[nrequests++]);
+        }
+        if(right)
+        {
+            MPI_Status status;
+            int count = 0;
+            MPI_Probe(RightProcess, RightDataTag, MPI_COMM_WORLD, &status);
+            MPI_Get_count(&status, MPI_DOUBLE, &count);
+            rright.resize(count);
+            MPI_Irecv(rright.data(), count, MPI_DOUBLE, RightProcess, RightDataTag, MPI_COMM_WORLD, &requests[nrequests++]);
+        }
     }
+    MPI_Waitall(nrequests, requests, MPI_STATUSES_IGNORE);
+
+    if(left)  storage.unpack(rleft,  Window(-bcells, 0));
+    if(right) storage.unpack(rright, Window(size, size + bcells));
+}
+
+template<typename A>
+inline void BoundaryConditions::Communicate([[maybe_unused]] A& storage) const
+{
+    const int RightProcess = (((MPI_RANK+1)%MPI_SIZE)+MPI_SIZE)%MPI_SIZE;
+    const int LeftProcess  = (((MPI_RANK-1)%MPI_SIZE)+MPI_SIZE)%MPI_SIZE;
+
+    ExchangeHalos(storage, 0, LeftProcess, RightProcess,
+                  MPI_RANK > 0 or MPIperiodicX,
+                  MPI_RANK < MPI_SIZE-1 or MPIperiodicX);
 }
 
 template<typename A>
@@ -2451,21 +2460,6 @@ inline void BoundaryConditions::CommunicateX([[maybe_unused]] A& storage) const
 {
     if(MPI_CART_SIZE[0] > 1)
     {
-        std::vector<double> sleft;
-        std::vector<double> rleft;
-        std::vector<double> sright;
-        std::vector<double> rright;
-        MPI_Request request_sleft;
-        MPI_Request request_sleft_size;
-        MPI_Request request_sright;
-        MPI_Request request_sright_size;
-        MPI_Request request_rleft;
-        MPI_Request request_rleft_size;
-        MPI_Request request_rright;
-        MPI_Request request_rright_size;
-
-        int sleft_size;
-        int sright_size;
         int RightProcess = MPI_CART_RANK[2] + MPI_CART_RANK[1] * MPI_CART_SIZE[2] + (MPI_CART_RANK[0] + 1) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
         int LeftProcess  = MPI_CART_RANK[2] + MPI_CART_RANK[1] * MPI_CART_SIZE[2] + (MPI_CART_RANK[0] - 1) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
 
@@ -2478,83 +2472,9 @@ inline void BoundaryConditions::CommunicateX([[maybe_unused]] A& storage) const
             LeftProcess  = MPI_CART_RANK[2] + MPI_CART_RANK[1] * MPI_CART_SIZE[2] + (MPI_CART_SIZE[0] - 1) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
         }
 
-        const int LeftSizeTag  = 0; // used to identify data stream
-        const int LeftDataTag  = 2; // used to identify data stream
-        const int RightSizeTag = 4; // used to identify data stream
-        const int RightDataTag = 8; // used to identify data stream
-
-        if (MPI_CART_RANK[0] > 0 or MPIperiodicX)
-        {
-            std::vector<long int> window(6);
-            window[0] = 0;
-            window[1] = storage.BcellsX();
-            window[2] = -storage.BcellsY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = -storage.BcellsZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            sleft = storage.pack(window);
-            sleft_size = sleft.size();
-            MPI_Isend(&sleft_size  , 1          , MPI_INT    , LeftProcess , RightSizeTag , MPI_COMM_WORLD , &request_sleft_size);
-            MPI_Isend(sleft.data() , sleft_size , MPI_DOUBLE , LeftProcess , RightDataTag , MPI_COMM_WORLD , &request_sleft);
-        }
-        if (MPI_CART_RANK[0] < MPI_CART_SIZE[0]-1 or MPIperiodicX)
-        {
-            std::vector<long int> window(6);
-            window[0] = storage.sizeX()-storage.BcellsX();
-            window[1] = storage.sizeX();
-            window[2] = -storage.BcellsY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = -storage.BcellsZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            sright = storage.pack(window);
-            sright_size = sright.size();
-            MPI_Isend(&sright_size  , 1           , MPI_INT    , RightProcess , LeftSizeTag , MPI_COMM_WORLD , &request_sright_size);
-            MPI_Isend(sright.data() , sright_size , MPI_DOUBLE , RightProcess , LeftDataTag , MPI_COMM_WORLD , &request_sright);
-        }
-        if (MPI_CART_RANK[0] > 0 or MPIperiodicX)
-        {
-            long int size = 0;
-            MPI_Irecv(&size, 1, MPI_INT, LeftProcess, LeftSizeTag, MPI_COMM_WORLD, &request_rleft_size);
-            MPI_Wait(&request_rleft_size, MPI_STATUS_IGNORE);
-            rleft.resize(size);
-            MPI_Irecv(rleft.data(), size, MPI_DOUBLE, LeftProcess, LeftDataTag, MPI_COMM_WORLD, &request_rleft);
-            MPI_Wait(&request_rleft, MPI_STATUS_IGNORE);
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = 0;
-            window[2] = -storage.BcellsY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = -storage.BcellsZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            storage.unpack(rleft,window);
-        }
-        if (MPI_CART_RANK[0] < MPI_CART_SIZE[0]-1 or MPIperiodicX)
-        {
-            long int size = 0;
-            MPI_Irecv(&size, 1, MPI_INT, RightProcess, RightSizeTag, MPI_COMM_WORLD, &request_rright_size);
-            MPI_Wait(&request_rright_size, MPI_STATUS_IGNORE);
-            rright.resize(size);
-            MPI_Irecv(rright.data(), size, MPI_DOUBLE, RightProcess, RightDataTag, MPI_COMM_WORLD, &request_rright);
-            MPI_Wait(&request_rright, MPI_STATUS_IGNORE);
-            std::vector<long int> window(6);
-            window[0] = storage.sizeX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = -storage.BcellsY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = -storage.BcellsZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            storage.unpack(rright,window);
-        }
-        if (MPI_CART_RANK[0] > 0 or MPIperiodicX)
-        {
-            MPI_Wait(&request_sleft, MPI_STATUS_IGNORE);
-            MPI_Wait(&request_sleft_size, MPI_STATUS_IGNORE);
-        }
-        if (MPI_CART_RANK[0] < MPI_CART_SIZE[0]-1 or MPIperiodicX)
-        {
-            MPI_Wait(&request_sright, MPI_STATUS_IGNORE);
-            MPI_Wait(&request_sright_size, MPI_STATUS_IGNORE);
-        }
+        ExchangeHalos(storage, 0, LeftProcess, RightProcess,
+                      MPI_CART_RANK[0] > 0 or MPIperiodicX,
+                      MPI_CART_RANK[0] < MPI_CART_SIZE[0]-1 or MPIperiodicX);
     }
 }
 
@@ -2563,22 +2483,6 @@ inline void BoundaryConditions::CommunicateY([[maybe_unused]] A& storage) const
 {
     if(MPI_CART_SIZE[1]>1)
     {
-        std::vector<double> sleft;
-        std::vector<double> rleft;
-        std::vector<double> sright;
-        std::vector<double> rright;
-        MPI_Request request_sleft;
-        MPI_Request request_sleft_size;
-        MPI_Request request_sright;
-        MPI_Request request_sright_size;
-        MPI_Request request_rleft;
-        MPI_Request request_rleft_size;
-        MPI_Request request_rright;
-        MPI_Request request_rright_size;
-
-        int sleft_size;
-        int sright_size;
-
         int RightProcess = MPI_CART_RANK[2] + (MPI_CART_RANK[1] + 1) * MPI_CART_SIZE[2] + (MPI_CART_RANK[0]) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
         int LeftProcess  = MPI_CART_RANK[2] + (MPI_CART_RANK[1] - 1) * MPI_CART_SIZE[2] + (MPI_CART_RANK[0]) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
 
@@ -2591,83 +2495,9 @@ inline void BoundaryConditions::CommunicateY([[maybe_unused]] A& storage) const
             LeftProcess  = MPI_CART_RANK[2] + (MPI_CART_SIZE[1] - 1) * MPI_CART_SIZE[2] + (MPI_CART_RANK[0]) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
         }
 
-        const int LeftSizeTag  = 0; // used to identify data stream
-        const int LeftDataTag  = 2; // used to identify data stream
-        const int RightSizeTag = 4; // used to identify data stream
-        const int RightDataTag = 8; // used to identify data stream
-
-        if (MPI_CART_RANK[1] > 0 or MPIperiodicY)
-        {
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = 0;
-            window[3] = storage.BcellsY();
-            window[4] = -storage.BcellsZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            sleft = storage.pack(window);
-            sleft_size = sleft.size();
-            MPI_Isend(&sleft_size  , 1          , MPI_INT    , LeftProcess , RightSizeTag , MPI_COMM_WORLD , &request_sleft_size);
-            MPI_Isend(sleft.data() , sleft_size , MPI_DOUBLE , LeftProcess , RightDataTag , MPI_COMM_WORLD , &request_sleft);
-        }
-        if (MPI_CART_RANK[1] < MPI_CART_SIZE[1]-1 or MPIperiodicY)
-        {
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = storage.sizeY()-storage.BcellsY();
-            window[3] = storage.sizeY();
-            window[4] = -storage.BcellsZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            sright = storage.pack(window);
-            sright_size = sright.size();
-            MPI_Isend(&sright_size  , 1           , MPI_INT    , RightProcess , LeftSizeTag , MPI_COMM_WORLD , &request_sright_size);
-            MPI_Isend(sright.data() , sright_size , MPI_DOUBLE , RightProcess , LeftDataTag , MPI_COMM_WORLD , &request_sright);
-        }
-        if (MPI_CART_RANK[1] > 0 or MPIperiodicY)
-        {
-            long int size = 0;
-            MPI_Irecv(&size, 1, MPI_INT, LeftProcess, LeftSizeTag, MPI_COMM_WORLD, &request_rleft_size);
-            MPI_Wait(&request_rleft_size, MPI_STATUS_IGNORE);
-            rleft.resize(size);
-            MPI_Irecv(rleft.data(), size, MPI_DOUBLE, LeftProcess, LeftDataTag, MPI_COMM_WORLD, &request_rleft);
-            MPI_Wait(&request_rleft, MPI_STATUS_IGNORE);
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = -storage.BcellsY();
-            window[3] = 0;
-            window[4] = -storage.BcellsZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            storage.unpack(rleft,window);
-        }
-        if (MPI_CART_RANK[1] < MPI_CART_SIZE[1]-1 or MPIperiodicY)
-        {
-            long int size = 0;
-            MPI_Irecv(&size, 1, MPI_INT, RightProcess, RightSizeTag, MPI_COMM_WORLD, &request_rright_size);
-            MPI_Wait(&request_rright_size, MPI_STATUS_IGNORE);
-            rright.resize(size);
-            MPI_Irecv(rright.data(), size, MPI_DOUBLE, RightProcess, RightDataTag, MPI_COMM_WORLD, &request_rright);
-            MPI_Wait(&request_rright, MPI_STATUS_IGNORE);
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = storage.sizeY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = -storage.BcellsZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            storage.unpack(rright,window);
-        }
-        if (MPI_CART_RANK[1] > 0 or MPIperiodicY)
-        {
-            MPI_Wait(&request_sleft, MPI_STATUS_IGNORE);
-            MPI_Wait(&request_sleft_size, MPI_STATUS_IGNORE);
-        }
-        if (MPI_CART_RANK[1] < MPI_CART_SIZE[1]-1 or MPIperiodicY)
-        {
-            MPI_Wait(&request_sright, MPI_STATUS_IGNORE);
-            MPI_Wait(&request_sright_size, MPI_STATUS_IGNORE);
-        }
+        ExchangeHalos(storage, 1, LeftProcess, RightProcess,
+                      MPI_CART_RANK[1] > 0 or MPIperiodicY,
+                      MPI_CART_RANK[1] < MPI_CART_SIZE[1]-1 or MPIperiodicY);
     }
 }
 
@@ -2676,22 +2506,6 @@ inline void BoundaryConditions::CommunicateZ([[maybe_unused]] A& storage) const
 {
     if(MPI_CART_SIZE[2] > 1)
     {
-        std::vector<double> sleft;
-        std::vector<double> rleft;
-        std::vector<double> sright;
-        std::vector<double> rright;
-        MPI_Request request_sleft;
-        MPI_Request request_sleft_size;
-        MPI_Request request_sright;
-        MPI_Request request_sright_size;
-        MPI_Request request_rleft;
-        MPI_Request request_rleft_size;
-        MPI_Request request_rright;
-        MPI_Request request_rright_size;
-
-        int sleft_size;
-        int sright_size;
-
         int RightProcess = MPI_CART_RANK[2] +1 + MPI_CART_RANK[1] * MPI_CART_SIZE[2] + (MPI_CART_RANK[0]) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
         int LeftProcess  = MPI_CART_RANK[2] -1 + MPI_CART_RANK[1] * MPI_CART_SIZE[2] + (MPI_CART_RANK[0]) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
 
@@ -2704,83 +2518,9 @@ inline void BoundaryConditions::CommunicateZ([[maybe_unused]] A& storage) const
             LeftProcess = MPI_CART_SIZE[2] - 1 + MPI_CART_RANK[1] * MPI_CART_SIZE[2] + (MPI_CART_RANK[0]) * MPI_CART_SIZE[1] * MPI_CART_SIZE[2];
         }
 
-        const int LeftSizeTag  = 0; // used to identify data stream
-        const int LeftDataTag  = 2; // used to identify data stream
-        const int RightSizeTag = 4; // used to identify data stream
-        const int RightDataTag = 8; // used to identify data stream
-
-        if(MPI_CART_RANK[2] > 0 or MPIperiodicZ)
-        {
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = -storage.BcellsY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = 0;
-            window[5] = storage.BcellsZ();
-            sleft = storage.pack(window);
-            sleft_size = sleft.size();
-            MPI_Isend(&sleft_size  , 1          , MPI_INT    , LeftProcess , RightSizeTag , MPI_COMM_WORLD , &request_sleft_size);
-            MPI_Isend(sleft.data() , sleft_size , MPI_DOUBLE , LeftProcess , RightDataTag , MPI_COMM_WORLD , &request_sleft);
-        }
-        if (MPI_CART_RANK[2] < MPI_CART_SIZE[2]-1 or MPIperiodicZ)
-        {
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = -storage.BcellsY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = storage.sizeZ()-storage.BcellsZ();
-            window[5] = storage.sizeZ();
-            sright = storage.pack(window);
-            sright_size = sright.size();
-            MPI_Isend(&sright_size  , 1           , MPI_INT    , RightProcess , LeftSizeTag , MPI_COMM_WORLD , &request_sright_size);
-            MPI_Isend(sright.data() , sright_size , MPI_DOUBLE , RightProcess , LeftDataTag , MPI_COMM_WORLD , &request_sright);
-        }
-        if (MPI_CART_RANK[2] > 0 or MPIperiodicZ)
-        {
-            long int size = 0;
-            MPI_Irecv(&size, 1, MPI_INT, LeftProcess, LeftSizeTag, MPI_COMM_WORLD, &request_rleft_size);
-            MPI_Wait(&request_rleft_size, MPI_STATUS_IGNORE);
-            rleft.resize(size);
-            MPI_Irecv(rleft.data(), size, MPI_DOUBLE, LeftProcess, LeftDataTag, MPI_COMM_WORLD, &request_rleft);
-            MPI_Wait(&request_rleft, MPI_STATUS_IGNORE);
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = -storage.BcellsY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = -storage.BcellsZ();
-            window[5] = 0;
-            storage.unpack(rleft,window);
-        }
-        if (MPI_CART_RANK[2] < MPI_CART_SIZE[2]-1 or MPIperiodicZ)
-        {
-            long int size = 0;
-            MPI_Irecv(&size, 1, MPI_INT, RightProcess, RightSizeTag, MPI_COMM_WORLD, &request_rright_size);
-            MPI_Wait(&request_rright_size, MPI_STATUS_IGNORE);
-            rright.resize(size);
-            MPI_Irecv(rright.data(), size, MPI_DOUBLE, RightProcess, RightDataTag, MPI_COMM_WORLD, &request_rright);
-            MPI_Wait(&request_rright, MPI_STATUS_IGNORE);
-            std::vector<long int> window(6);
-            window[0] = -storage.BcellsX();
-            window[1] = storage.sizeX()+storage.BcellsX();
-            window[2] = -storage.BcellsY();
-            window[3] = storage.sizeY()+storage.BcellsY();
-            window[4] = storage.sizeZ();
-            window[5] = storage.sizeZ()+storage.BcellsZ();
-            storage.unpack(rright,window);
-        }
-        if (MPI_CART_RANK[2] > 0 or MPIperiodicZ)
-        {
-            MPI_Wait(&request_sleft, MPI_STATUS_IGNORE);
-            MPI_Wait(&request_sleft_size, MPI_STATUS_IGNORE);
-        }
-        if (MPI_CART_RANK[2] < MPI_CART_SIZE[2]-1 or MPIperiodicZ)
-        {
-            MPI_Wait(&request_sright, MPI_STATUS_IGNORE);
-            MPI_Wait(&request_sright_size, MPI_STATUS_IGNORE);
-        }
+        ExchangeHalos(storage, 2, LeftProcess, RightProcess,
+                      MPI_CART_RANK[2] > 0 or MPIperiodicZ,
+                      MPI_CART_RANK[2] < MPI_CART_SIZE[2]-1 or MPIperiodicZ);
     }
 }
 
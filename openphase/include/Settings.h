@@ -76,6 +76,7 @@ class OP_EXPORTS Settings
     std::vector<size_t> Nvariants;                                              ///< Number of crystallographic (symmetry/translation/...) variants
 
     Resolutions Resolution;                                                     ///< Phase field resolution (Single or Double)
+    VTKFormats  VTKFormat;                                                      ///< VTK output format (ASCII, Binary or Compressed)
 
     LaplacianStencils DiffusionStencil;                                         ///< Diffusion stencil selector
     LaplacianStencils PhaseFieldLaplacianStencil;                               ///< Phase-field Laplacian stencil selector
@@ -189,6 +189,13 @@ struct OP_EXPORTS VTK
             const int precision = 16,
             const int resolution = 1);
 
+    /// Writes a list of fields into a binary (raw or zlib compressed) VTK ImageData file
+    static void WriteBinary(
+            const std::string Filename,
+            const Settings& locSettings,
+            std::vector<Field_t> ListOfFields,
+            const int resolution = 1);
+
     static void WriteDistorted(
             const std::string Filename,
             const Settings& locSettings,
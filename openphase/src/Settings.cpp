@@ -73,6 +73,7 @@ void Settings::Initialize(void)
     Ncomp = 0;
 
     Resolution = Resolutions::Single;
+    VTKFormat  = VTKFormats::ASCII;
     ConsiderNucleusVolume = false;
 
     DiffusionStencil = LaplacianStencils::Isotropic;
@@ -225,6 +226,30 @@ void Settings::ReadInput(std::stringstream& inp)
         PhaseFieldGradientStencil = GradientStencils::LB;
     }
 
+    string tmp4 = UserInterface::ReadParameterK(inp, moduleLocation, string("VTKFormat"), false, string("ASCII"));
+    if(tmp4 == "ASCII")
+    {
+        VTKFormat = VTKFormats::ASCII;
+    }
+    else if(tmp4 == "BINARY")
+    {
+        VTKFormat = VTKFormats::Binary;
+    }
+    else if(tmp4 == "COMPRESSED")
+    {
+#ifdef ZLIB_OP
+        VTKFormat = VTKFormats::Compressed;
+#else
+        Info::WriteWarning("OpenPhase is compiled without zlib support, falling back to BINARY VTK output", thisclassname, "ReadInput()");
+        VTKFormat = VTKFormats::Binary;
+#endif
+    }
+    else
+    {
+        Info::WriteExit("Wrong VTK format selected -> " + tmp4, thisclassname, "ReadInput()");
+        exit(1);
+    }
+
     move_frame_phase     = UserInterface::ReadParameterI(inp, moduleLocation, string("MoveFramePhase"), false, -1);
     move_frame_pos       = UserInterface::ReadParameterI(inp, moduleLocation, string("MoveFramePosition"), false, -1);
     move_frame_direction = UserInterface::ReadParameterS(inp, moduleLocation, string("MoveFrameDirection"), false, "No");
@@ -577,6 +602,7 @@ Settings& Settings::operator= (const Settings& rhs)
         Ncomp   = rhs.Ncomp;
 
         Resolution = rhs.Resolution;
+        VTKFormat  = rhs.VTKFormat;
         DiffusionStencil = rhs.DiffusionStencil;
         PhaseFieldLaplacianStencil = rhs.PhaseFieldLaplacianStencil;
         PhaseFieldGradientStencil = rhs.PhaseFieldGradientStencil;
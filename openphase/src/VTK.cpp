@@ -30,6 +30,10 @@
 #include "Base/UserInterface.h"
 #include "Info.h"
 
+#ifdef ZLIB_OP
+#include <zlib.h>
+#endif
+
 namespace openphase
 {
 
@@ -38,6 +42,172 @@ using namespace std;
 vector<string> voigtcon {"xx", "yy", "zz", "yz", "xz", "xy"};
 vector<string> matrixcon  {"xx", "xy", "xz", "yx", "yy", "yz", "zx", "zy", "zz"};
 
+struct BinaryField_t                                                            ///< Field data prepared for the binary output
+{
+    string Name;                                                                ///< Field name
+    string Type;                                                                ///< VTK data type of the field components
+    size_t NComponents;                                                         ///< Number of components per point
+    VTKDataTypes DataType;                                                      ///< Scalar, vector or tensor data
+    vector<char> Data;                                                          ///< Encoded field data including the VTK block header
+};
+
+template <typename T, typename value_t, size_t NComponents, class extract_t>
+static void GatherField(BinaryField_t& Out, const VTK::Field_t& Field,
+                        const long int Nx, const long int Ny, const long int Nz,
+                        extract_t Extract)
+{
+    Out.NComponents = NComponents;
+    Out.Data.resize(Nx*Ny*Nz*NComponents*sizeof(value_t));
+    value_t* ptr = reinterpret_cast<value_t*>(Out.Data.data());
+    for(long int k = 0; k < Nz; ++k)
+    for(long int j = 0; j < Ny; ++j)
+    for(long int i = 0; i < Nx; ++i)
+    {
+        Extract(std::any_cast<T>(Field.Function(i,j,k)), ptr);
+        ptr += NComponents;
+    }
+}
+
+static bool ResolveField(BinaryField_t& Out, const VTK::Field_t& Field,
+                         const long int Nx, const long int Ny, const long int Nz)
+{
+    /// The field type is determined once and the whole field is gathered
+    /// into a contiguous array of the corresponding VTK type.
+    const std::type_info& type = Field.Function(0,0,0).type();
+    Out.Name = Field.Name;
+
+    auto voigt = [](const auto& in, double* out)                                // VTK symmetric tensor order: xx yy zz xy yz xz
+    {
+        out[0] = in[0]; out[1] = in[1]; out[2] = in[2];
+        out[3] = in[5]; out[4] = in[3]; out[5] = in[4];
+    };
+
+    if (type == typeid(int))
+    {
+        Out.Type = "Int32";
+        Out.DataType = VTKDataTypes::PDScalars;
+        GatherField<int,int32_t,1>(Out,Field,Nx,Ny,Nz,[](const int& val, int32_t* out){out[0] = val;});
+    }
+    else if (type == typeid(size_t))
+    {
+        Out.Type = "UInt64";
+        Out.DataType = VTKDataTypes::PDScalars;
+        GatherField<size_t,uint64_t,1>(Out,Field,Nx,Ny,Nz,[](const size_t& val, uint64_t* out){out[0] = val;});
+    }
+    else if (type == typeid(double))
+    {
+        Out.Type = "Float64";
+        Out.DataType = VTKDataTypes::PDScalars;
+        GatherField<double,double,1>(Out,Field,Nx,Ny,Nz,[](const double& val, double* out){out[0] = val;});
+    }
+    else if (type == typeid(dVector3))
+    {
+        Out.Type = "Float64";
+        Out.DataType = VTKDataTypes::PDVectors;
+        GatherField<dVector3,double,3>(Out,Field,Nx,Ny,Nz,[](const dVector3& val, double* out){for(int n = 0; n < 3; n++) out[n] = val[n];});
+    }
+    else if (type == typeid(dVector6))
+    {
+        Out.Type = "Float64";
+        Out.DataType = VTKDataTypes::PDVectors;
+        GatherField<dVector6,double,6>(Out,Field,Nx,Ny,Nz,[&voigt](const dVector6& val, double* out){voigt(val, out);});
+    }
+    else if (type == typeid(vStrain))
+    {
+        Out.Type = "Float64";
+        Out.DataType = VTKDataTypes::PDVectors;
+        GatherField<vStrain,double,6>(Out,Field,Nx,Ny,Nz,[&voigt](const vStrain& val, double* out){voigt(val, out);});
+    }
+    else if (type == typeid(vStress))
+    {
+        Out.Type = "Float64";
+        Out.DataType = VTKDataTypes::PDVectors;
+        GatherField<vStress,double,6>(Out,Field,Nx,Ny,Nz,[&voigt](const vStress& val, double* out){voigt(val, out);});
+    }
+    else if (type == typeid(dMatrix3x3))
+    {
+        Out.Type = "Float64";
+        Out.DataType = VTKDataTypes::PDTensors;
+        GatherField<dMatrix3x3,double,9>(Out,Field,Nx,Ny,Nz,[](const dMatrix3x3& val, double* out){memcpy(out, val.const_data(), 9*sizeof(double));});
+    }
+    else if (type == typeid(dMatrix6x6))
+    {
+        Out.Type = "Float64";
+        Out.DataType = VTKDataTypes::PDTensors;
+        GatherField<dMatrix6x6,double,36>(Out,Field,Nx,Ny,Nz,[](const dMatrix6x6& val, double* out){memcpy(out, val.const_data(), 36*sizeof(double));});
+    }
+    else
+    {
+        Info::WriteWarning("Unsupported data type of the field \"" + Field.Name + "\" is skipped", "VTK", "WriteBinary()");
+        return false;
+    }
+    return true;
+}
+
+static void EncodeField(vector<char>& Data, const bool compress)
+{
+    /// Converts raw field data into a VTK appended data block with
+    /// UInt64 header: either [nbytes][data] or, if compressed,
+    /// [nblocks][blocksize][lastblocksize][csize_1..csize_n][zlib blocks]
+    const uint64_t nbytes = Data.size();
+    vector<char> Encoded;
+    if(!compress)
+    {
+        Encoded.resize(sizeof(uint64_t) + nbytes);
+        memcpy(Encoded.data(), &nbytes, sizeof(uint64_t));
+        memcpy(Encoded.data() + sizeof(uint64_t), Data.data(), nbytes);
+    }
+#ifdef ZLIB_OP
+    else
+    {
+        const uint64_t blocksize = 1 << 20;
+        const uint64_t nblocks = (nbytes + blocksize - 1)/blocksize;
+        const uint64_t lastblocksize = (nblocks) ? nbytes - (nblocks - 1)*blocksize : 0;
+
+        vector<uint64_t> header(3 + nblocks);
+        header[0] = nblocks;
+        header[1] = blocksize;
+        header[2] = lastblocksize;
+
+        vector<vector<char>> Blocks(nblocks);
+        for(uint64_t n = 0; n < nblocks; n++)
+        {
+            const uint64_t size = (n == nblocks - 1) ? lastblocksize : blocksize;
+            uLongf csize = compressBound(size);
+            Blocks[n].resize(csize);
+            compress2(reinterpret_cast<Bytef*>(Blocks[n].data()), &csize,
+                      reinterpret_cast<const Bytef*>(Data.data() + n*blocksize), size, Z_BEST_SPEED);
+            Blocks[n].resize(csize);
+            header[3 + n] = csize;
+        }
+        Encoded.resize(header.size()*sizeof(uint64_t));
+        memcpy(Encoded.data(), header.data(), header.size()*sizeof(uint64_t));
+        for(auto& Block : Blocks)
+        {
+            Encoded.insert(Encoded.end(), Block.begin(), Block.end());
+        }
+    }
+#endif
+    Data.swap(Encoded);
+}
+
+#ifdef MPI_PARALLEL
+static void WriteAtAllChunked(MPI_File& fh, MPI_Offset offset, const char* data, size_t size)
+{
+    /// Collective write split into chunks to stay within the int count limit of MPI
+    const size_t chunksize = size_t(1) << 30;
+    unsigned long long nchunks = (size + chunksize - 1)/chunksize;
+    MPI_Allreduce(MPI_IN_PLACE, &nchunks, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Status status;
+    for(size_t n = 0; n < nchunks; n++)
+    {
+        const size_t begin = std::min(n*chunksize, size);
+        const size_t count = std::min(chunksize, size - begin);
+        MPI_File_write_at_all(fh, offset + begin, data + begin, count, MPI_CHAR, &status);
+    }
+}
+#endif
+
 
 void VTK::Write(
     const std::string Filename,
@@ -50,6 +220,12 @@ void VTK::Write(
     const int Ny = (resolution == 1) ? locSettings.Ny : (locSettings.dNy + 1)*locSettings.Ny;
     const int Nz = (resolution == 1) ? locSettings.Nz : (locSettings.dNz + 1)*locSettings.Nz;
 
+    if(locSettings.VTKFormat != VTKFormats::ASCII)
+    {
+        WriteBinary(Filename, locSettings, ListOfFields, resolution);
+        return;
+    }
+
 #ifndef MPI_PARALLEL
     ofstream vtk_file(Filename.c_str());
     VTK::WriteHeader(vtk_file, Nx, Ny, Nz);
@@ -137,6 +313,160 @@ void VTK::Write(
 #endif
 }
 
+void VTK::WriteBinary(
+    const std::string Filename,
+    const Settings& locSettings,
+    std::vector<Field_t> ListOfFields,
+    const int resolution)
+{
+    const int Nx = (resolution == 1) ? locSettings.Nx : (locSettings.dNx + 1)*locSettings.Nx;
+    const int Ny = (resolution == 1) ? locSettings.Ny : (locSettings.dNy + 1)*locSettings.Ny;
+    const int Nz = (resolution == 1) ? locSettings.Nz : (locSettings.dNz + 1)*locSettings.Nz;
+
+    const int TotalNx = (resolution == 1) ? locSettings.TotalNx : (locSettings.dNx + 1)*locSettings.TotalNx;
+    const int TotalNy = (resolution == 1) ? locSettings.TotalNy : (locSettings.dNy + 1)*locSettings.TotalNy;
+    const int TotalNz = (resolution == 1) ? locSettings.TotalNz : (locSettings.dNz + 1)*locSettings.TotalNz;
+
+    const int OffsetX = (resolution == 1) ? locSettings.OffsetX : (locSettings.dNx + 1)*locSettings.OffsetX;
+    const int OffsetY = (resolution == 1) ? locSettings.OffsetY : (locSettings.dNy + 1)*locSettings.OffsetY;
+    const int OffsetZ = (resolution == 1) ? locSettings.OffsetZ : (locSettings.dNz + 1)*locSettings.OffsetZ;
+
+    // Grid spacing consistent with VTK::WriteCoordinates()
+    double a = 1.0;
+    double b = 1.0;
+    double c = 1.0;
+    if(resolution == 2)
+    {
+        a = (locSettings.TotalNx-1) ? (locSettings.TotalNx*0.5 - 0.25)/(locSettings.TotalNx) : 1.0;
+        b = (locSettings.TotalNy-1) ? (locSettings.TotalNy*0.5 - 0.25)/(locSettings.TotalNy) : 1.0;
+        c = (locSettings.TotalNz-1) ? (locSettings.TotalNz*0.5 - 0.25)/(locSettings.TotalNz) : 1.0;
+    }
+
+    const bool compress = (locSettings.VTKFormat == VTKFormats::Compressed);
+
+    vector<BinaryField_t> Fields;
+    Fields.reserve(ListOfFields.size());
+    for (auto& Field : ListOfFields)
+    {
+        BinaryField_t locField;
+        if(ResolveField(locField, Field, Nx, Ny, Nz))
+        {
+            EncodeField(locField.Data, compress);
+            Fields.push_back(std::move(locField));
+        }
+    }
+
+    uint64_t datasize = 0;
+    for (auto& Field : Fields)
+    {
+        datasize += Field.Data.size();
+    }
+    uint64_t dataoffset = 0;
+#ifdef MPI_PARALLEL
+    MPI_Exscan(&datasize, &dataoffset, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    if (MPI_RANK == 0) dataoffset = 0;
+#endif
+
+    // Use type with highest dimensions to label the point data
+    string PointDataType = "Scalars= \"ScalarData\"";
+    for (auto& Field : Fields)
+    if (Field.DataType == VTKDataTypes::PDVectors)
+    {
+        PointDataType = "Vectors= \"VectorData\"";
+    }
+    for (auto& Field : Fields)
+    if (Field.DataType == VTKDataTypes::PDTensors)
+    {
+        PointDataType = "Tensors= \"TensorData\"";
+    }
+
+    stringstream hbuffer;
+    hbuffer << "<?xml version= \"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n";
+    hbuffer << "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\"";
+    if(compress) hbuffer << " compressor=\"vtkZLibDataCompressor\"";
+    hbuffer << ">\n";
+    hbuffer << "<ImageData WholeExtent=\""
+            << 0 << " " << TotalNx-1 << " "
+            << 0 << " " << TotalNy-1 << " "
+            << 0 << " " << TotalNz-1 << "\" Origin=\"0 0 0\" Spacing=\""
+            << std::setprecision(16) << a << " " << b << " " << c << "\">\n";
+
+    stringstream buffer;
+    buffer << "<Piece Extent=\""
+           << OffsetX << " " << Nx-1 + OffsetX << " "
+           << OffsetY << " " << Ny-1 + OffsetY << " "
+           << OffsetZ << " " << Nz-1 + OffsetZ << "\">\n";
+    buffer << "<PointData " << PointDataType << ">\n";
+    uint64_t offset = dataoffset;
+    for (auto& Field : Fields)
+    {
+        buffer << "<DataArray type=\"" << Field.Type
+               << "\" Name=\"" << Field.Name
+               << "\" NumberOfComponents=\"" << Field.NComponents
+               << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+        offset += Field.Data.size();
+    }
+    buffer << "</PointData>\n";
+    buffer << "</Piece>\n";
+
+    const string mbuffer = "</ImageData>\n<AppendedData encoding=\"raw\">\n_";
+    const string tbuffer = "\n</AppendedData>\n</VTKFile>\n";
+
+#ifndef MPI_PARALLEL
+    ofstream vtk_file(Filename.c_str(), ios::out | ios::binary);
+    vtk_file << hbuffer.rdbuf();
+    vtk_file << buffer.rdbuf();
+    vtk_file << mbuffer;
+    for (auto& Field : Fields)
+    {
+        vtk_file.write(Field.Data.data(), Field.Data.size());
+    }
+    vtk_file << tbuffer;
+    vtk_file.close();
+#else
+    vector<char> LocalData;
+    LocalData.reserve(datasize);
+    for (auto& Field : Fields)
+    {
+        LocalData.insert(LocalData.end(), Field.Data.begin(), Field.Data.end());
+        vector<char>().swap(Field.Data);
+    }
+
+    const string header = hbuffer.str();
+    const string piece  = buffer.str();
+
+    uint64_t piecesize = piece.size();
+    uint64_t pieceoffset = 0;
+    uint64_t totalpiecesize = 0;
+    uint64_t totaldatasize = 0;
+    MPI_Exscan(&piecesize, &pieceoffset, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    if (MPI_RANK == 0) pieceoffset = 0;
+    MPI_Allreduce(&piecesize, &totalpiecesize, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&datasize, &totaldatasize, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+
+    const MPI_Offset headersize   = header.size();
+    const MPI_Offset appendedbase = headersize + totalpiecesize + mbuffer.size();
+
+    MPI_File fh;
+    MPI_Status status;
+    MPI_File_delete(Filename.c_str(), MPI_INFO_NULL);
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_File_open(MPI_COMM_WORLD, Filename.c_str(),
+        MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
+    MPI_File_set_view(fh, 0, MPI_CHAR, MPI_CHAR, "native", MPI_INFO_NULL);
+
+    if (MPI_RANK == 0)
+    {
+        MPI_File_write_at(fh, 0, header.c_str(), header.size(), MPI_CHAR, &status);
+        MPI_File_write_at(fh, headersize + totalpiecesize, mbuffer.c_str(), mbuffer.size(), MPI_CHAR, &status);
+        MPI_File_write_at(fh, appendedbase + totaldatasize, tbuffer.c_str(), tbuffer.size(), MPI_CHAR, &status);
+    }
+    MPI_File_write_at_all(fh, headersize + pieceoffset, piece.c_str(), piece.size(), MPI_CHAR, &status);
+    WriteAtAllChunked(fh, appendedbase + dataoffset, LocalData.data(), LocalData.size());
+    MPI_File_close(&fh);
+#endif
+}
+
 void VTK::WriteDistorted(
     const std::string Filename,
     const Settings& locSettings,